@@ -10,32 +10,93 @@ int i = 1;
 namespace cache_library {
 
     adaptive_cache::adaptive_cache(std::shared_ptr<i_cache_strategy> strategy)
-        : cacheStrategy(std::move(strategy)) {}
+        : cacheStrategy(std::move(strategy)) {
+        install_eviction_listener();
+    }
 
     adaptive_cache::adaptive_cache(const std::shared_ptr<i_cache>& lru_cache_ptr, const std::shared_ptr<i_cache>&
                                    mru_cache_ptr) {
         // Створюємо стратегію за замовчуванням
         cacheStrategy = std::make_shared<concrete_cache_strategy>(lru_cache_ptr, mru_cache_ptr);
+        install_eviction_listener();
+    }
+
+    adaptive_cache::adaptive_cache(std::shared_ptr<i_cache_strategy> strategy, const l1_cache_options& l1_options)
+        : cacheStrategy(std::move(strategy)), l1_cache_(std::make_shared<l1_front_cache>(l1_options)) {
+        install_eviction_listener();
+    }
+
+    void adaptive_cache::install_eviction_listener()
+    {
+        // Витіснення відбувається під час вставки іншого ключа: скидаємо L1 і статистику витісненого ключа.
+        // Стратегія володіє кешами, тому тримаємо її слабким указівником, щоб не утворити цикл
+        auto on_evict = [strategy = std::weak_ptr<i_cache_strategy>(cacheStrategy),
+                         l1 = std::weak_ptr<l1_front_cache>(l1_cache_)](const int key) {
+            if (const auto cache = l1.lock()) {
+                cache->invalidate(key);
+            }
+            if (const auto owner = strategy.lock()) {
+                if (!owner->lruCache()->contains(key) && !owner->mruCache()->contains(key)) {
+                    owner->forget_key(key);
+                }
+            }
+        };
+        cacheStrategy->lruCache()->set_eviction_listener(on_evict);
+        cacheStrategy->mruCache()->set_eviction_listener(on_evict);
     }
 
     void adaptive_cache::insert(const int key, const int value) const
     {
+        std::lock_guard lock(*mutex_);
+
         // Вибираємо відповідний кеш
         const auto cache = cacheStrategy->select_cache(key);
 
         // Вставляємо в обраний кеш
         cache->insert(key, value);
 
+        // Скидаємо копії ключа в L1 кешах потоків
+        if (l1_cache_) {
+            l1_cache_->invalidate(key);
+        }
+
         // Оновлюємо стратегію з ключем
         cacheStrategy->update_strategy(key);
     }
 
+    void adaptive_cache::remove(const int key) const
+    {
+        std::lock_guard lock(*mutex_);
+        cacheStrategy->lruCache()->remove(key);
+        cacheStrategy->mruCache()->remove(key);
+        cacheStrategy->forget_key(key);
+
+        if (l1_cache_) {
+            l1_cache_->invalidate(key);
+        }
+    }
+
 
 
     int adaptive_cache::get(const int key) const
     {
         int value = -1;
 
+        // Гарячі ключі віддаємо з L1 без звернення до спільних кешів
+        std::uint64_t l1_version = 0;
+        if (l1_cache_) {
+            bool touch = false;
+            if (l1_cache_->lookup(key, value, touch)) {
+                if (touch) {
+                    touch_shared_cache(key);
+                }
+                return value;
+            }
+            l1_version = l1_cache_->version(key);
+        }
+
+        std::unique_lock lock(*mutex_);
+
         const auto lru_cache = cacheStrategy->lruCache();
         const auto mru_cache = cacheStrategy->mruCache();
 
@@ -54,13 +115,39 @@ namespace cache_library {
         if (value != -1) {
             // Оновлюємо стратегію з ключем
             cacheStrategy->update_strategy(key);
+            lock.unlock();
+
+            if (l1_cache_) {
+                l1_cache_->fill(key, value, l1_version);
+            }
         }
 
         return value;
     }
 
+    void adaptive_cache::touch_shared_cache(const int key) const
+    {
+        // Без цього LRU/MRU не бачать попадань у L1 і вважали б найгарячіші ключі холодними
+        std::lock_guard lock(*mutex_);
+
+        const auto lru_cache = cacheStrategy->lruCache();
+        const auto mru_cache = cacheStrategy->mruCache();
+
+        if (lru_cache->contains(key)) {
+            lru_cache->get(key);
+        }
+        else if (mru_cache->contains(key)) {
+            mru_cache->get(key);
+        }
+    }
+
+    l1_cache_stats adaptive_cache::l1_stats() const {
+        return l1_cache_ ? l1_cache_->stats() : l1_cache_stats{};
+    }
+
     std::vector<int> adaptive_cache::filter(const std::function<bool(int)>& predicate) const {
         std::vector<int> result;
+        std::lock_guard lock(*mutex_);
 
         const auto lru_cache = cacheStrategy->lruCache();
         const auto mru_cache = cacheStrategy->mruCache();
@@ -83,12 +170,14 @@ namespace cache_library {
     }
 
     std::vector<int> adaptive_cache::sort(std::function<bool(int, int)> comparator) const {
+        std::unique_lock lock(*mutex_);
 	    const auto lru_cache = cacheStrategy->lruCache();
 	    const auto mru_cache = cacheStrategy->mruCache();
 
         std::vector<int> all_keys = lru_cache->get_keys();
         std::vector<int> mru_keys = mru_cache->get_keys();
         all_keys.insert(all_keys.end(), mru_keys.begin(), mru_keys.end());
+        lock.unlock();
 
         std::ranges::sort(all_keys, std::move(comparator));
 
@@ -119,8 +208,17 @@ namespace cache_library {
     }
     void adaptive_cache::display_cache_status() const {
         std::cout << "Cache Status:\n";
-        cacheStrategy->lruCache()->display_status();
-        cacheStrategy->mruCache()->display_status();
+        {
+            std::lock_guard lock(*mutex_);
+            cacheStrategy->lruCache()->display_status();
+            cacheStrategy->mruCache()->display_status();
+        }
+
+        if (l1_cache_) {
+            const l1_cache_stats stats = l1_cache_->stats();
+            std::cout << "L1 Cache: hits " << stats.hits << ", misses " << stats.misses
+                << ", hit ratio " << stats.hit_ratio() << '\n';
+        }
     }
 
 } // namespace cache_library
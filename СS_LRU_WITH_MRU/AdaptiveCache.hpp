@@ -3,18 +3,29 @@
 
 #include "ICache.hpp"
 #include "ICacheStrategy.hpp"
+#include "L1FrontCache.hpp"
 #include <unordered_map>
 #include <string>
 #include <vector>
 #include <functional>
 #include <chrono>
 #include <memory>
+#include <mutex>
 
 namespace cache_library {
 
     /**
      * @class adaptive_cache
      * @brief Адаптивний кеш, який перемикається між алгоритмами LRU та MRU залежно від дисперсії доступу.
+     *
+     * Усі звернення до LRU/MRU кешів та стратегії виконуються під одним м'ютексом, тому екземпляр
+     * можна використовувати з кількох потоків. Без блокування проходять лише попадання в L1 кеш.
+     * Кожен конструктор встановлює обробник витіснення в LRU та MRU кешах, який скидає статистику
+     * стратегії (та L1) для витісненого ключа; ці кеші не слід ділити з іншим adaptive_cache.
+     * @en All access to the LRU/MRU caches and the strategy happens under one mutex, so an instance
+     * may be used from several threads. Only L1 cache hits bypass the lock.
+     * Every constructor installs an eviction listener on the LRU and MRU caches that drops the strategy's
+     * (and L1's) state for the evicted key; do not share these caches with another adaptive_cache.
      */
     class adaptive_cache  {
     public:
@@ -31,16 +42,49 @@ namespace cache_library {
          */
         adaptive_cache(const std::shared_ptr<i_cache>& lru_cache_ptr, const std::shared_ptr<i_cache>& mru_cache_ptr);
 
+        /**
+         * @brief Конструктор з потоковим L1 кешем перед спільними кешами.
+         * @en Constructor with a per-thread L1 cache in front of the shared caches.
+         * @param strategy Указівник на стратегію вибору кешу.
+         * @param l1_options Налаштування L1 кешу.
+         * @en L1 cache settings.
+         *
+         * Попадання в L1 не беруть м'ютекс і не оновлюють стратегію; давність ключа в LRU/MRU оновлюється
+         * лише на кожному touch_period-му попаданні. Витіснені ключі не віддаються з L1.
+         * @en L1 hits take no mutex and do not update the strategy; the key's recency in LRU/MRU is refreshed
+         * only on every touch_period-th hit. Evicted keys are not served from L1.
+         */
+        adaptive_cache(std::shared_ptr<i_cache_strategy> strategy, const l1_cache_options& l1_options);
+
         void insert(int key, int value) const;
         int get(int key) const;
+
+        /**
+         * @brief Видалення ключа з обох кешів.
+         * @en Remove a key from both caches.
+         * @param key Ключ для видалення.
+         * @en Key to remove.
+         */
+        void remove(int key) const;
+
+        /**
+         * @brief Статистика L1 кешу (нулі, якщо L1 вимкнено).
+         * @en L1 cache statistics (zeros when L1 is disabled).
+         */
+        [[nodiscard]] l1_cache_stats l1_stats() const;
+
         std::vector<int> filter(const std::function<bool(int)>& predicate) const;
         std::vector<int> sort(std::function<bool(int, int)> comparator) const;
         void display_cache_status() const;
 
     private:
         std::shared_ptr<i_cache_strategy> cacheStrategy; ///< Указівник на стратегію кешування.
+        std::shared_ptr<l1_front_cache> l1_cache_; ///< Потоковий L1 кеш або nullptr.
+        std::shared_ptr<std::mutex> mutex_ = std::make_shared<std::mutex>(); ///< Спільний з копіями, як і кеші, які він захищає.
         const std::string archiveFilePath_ = "archive.txt"; ///< Шлях до файлу архіву.
         std::string last_algorithm_; ///< Останній використаний алгоритм кешування.
+        void install_eviction_listener();
+        void touch_shared_cache(int key) const;
         static double calculate_sha256(const std::string& data);
         void write_to_archive_file(int key, double checksum) const;
         // Інші приватні члени, якщо необхідно
@@ -0,0 +1,197 @@
+// Бенчмарк кількості виділень пам'яті для кешів з std::pmr::memory_resource.
+// @en Allocation-count benchmark for caches backed by std::pmr::memory_resource.
+//
+// Окрема програма, виключена зі збірки прикладу. Збірка:
+// @en Standalone program, excluded from the example build. Build with:
+//   g++ -std=c++20 -O2 AllocationBenchmark.cpp AdaptiveCache.cpp ConcreteCacheStrategy.cpp
+//       L1FrontCache.cpp LRU_Cache.cpp MRU_Cache.cpp -lcrypto -o allocation_benchmark
+
+#include "AdaptiveCache.hpp"
+#include "ConcreteCacheStrategy.hpp"
+#include "LRU_Cache.hpp"
+#include "MRU_Cache.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <vector>
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+namespace {
+
+    std::atomic<std::size_t> heap_calls{ 0 }; ///< Кількість викликів глобального operator new.
+
+    /**
+     * @class counting_resource
+     * @brief Обгортка над upstream ресурсом, яка рахує звернення до нього.
+     * @en Wrapper over an upstream resource that counts calls into it.
+     */
+    class counting_resource final : public std::pmr::memory_resource {
+    public:
+        explicit counting_resource(std::pmr::memory_resource* upstream) : upstream_(upstream) {}
+
+        std::size_t allocations = 0;
+
+    private:
+        void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+            ++allocations;
+            return upstream_->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, const std::size_t bytes, const std::size_t alignment) override {
+            upstream_->deallocate(p, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+
+        std::pmr::memory_resource* upstream_;
+    };
+
+    struct phase_result {
+        std::size_t heap_calls;
+        std::size_t upstream_calls;
+        double ns_per_op;
+    };
+
+    template <typename Operation>
+    phase_result measure(const counting_resource& upstream, const int iterations, Operation operation) {
+        const std::size_t heap_before = heap_calls.load();
+        const std::size_t upstream_before = upstream.allocations;
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < iterations; ++i) {
+            operation(i);
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return {
+            heap_calls.load() - heap_before,
+            upstream.allocations - upstream_before,
+            std::chrono::duration<double, std::nano>(elapsed).count() / iterations
+        };
+    }
+
+    void print(const char* name, const phase_result& result) {
+        std::cout << "  " << name << ": heap calls " << result.heap_calls
+            << ", upstream calls " << result.upstream_calls
+            << ", " << result.ns_per_op << " ns/op\n";
+    }
+
+    void run(const char* title, std::pmr::memory_resource* upstream_resource, const bool use_pool) {
+        constexpr int capacity = 256;
+        constexpr int iterations = 1'000'000;
+        constexpr int adaptive_iterations = iterations / 100; ///< update_strategy перераховує дисперсії за O(n).
+
+        counting_resource upstream(upstream_resource);
+        std::pmr::unsynchronized_pool_resource pool(&upstream);
+        std::pmr::memory_resource* resource = use_pool ? static_cast<std::pmr::memory_resource*>(&pool) : &upstream;
+
+        const auto lru = std::make_shared<cache_library::lru_cache>(capacity, resource);
+        const auto mru = std::make_shared<cache_library::mru_cache>(capacity, resource);
+        const auto strategy = std::make_shared<cache_library::concrete_cache_strategy>(lru, mru, resource);
+        const cache_library::adaptive_cache cache(strategy);
+
+        // Прогрів: заповнюємо обидва кеші та таблиці стратегії через adaptive_cache
+        int next_key = 0;
+        while (lru->get_keys().size() < capacity || mru->get_keys().size() < capacity) {
+            cache.insert(next_key, next_key);
+            ++next_key;
+        }
+        const std::vector<int> lru_keys = lru->get_keys();
+        const std::vector<int> mru_keys = mru->get_keys();
+        const std::vector<int> all_keys = cache.filter([](int) { return true; });
+
+        std::cout << title << '\n';
+        print("lru_cache::get hit", measure(upstream, iterations, [&](const int i) { lru->get(lru_keys[i % lru_keys.size()]); }));
+        print("mru_cache::get hit", measure(upstream, iterations, [&](const int i) { mru->get(mru_keys[i % mru_keys.size()]); }));
+        print("adaptive_cache::get hit", measure(upstream, adaptive_iterations, [&](const int i) { cache.get(all_keys[i % all_keys.size()]); }));
+
+        // Переписування наявних ключів та витіснення
+        print("lru_cache::insert existing", measure(upstream, iterations, [&](const int i) { lru->insert(lru_keys[i % lru_keys.size()], i); }));
+        print("adaptive_cache::insert existing", measure(upstream, adaptive_iterations, [&](const int i) { cache.insert(all_keys[i % all_keys.size()], i); }));
+        print("lru_cache::insert evicting", measure(upstream, iterations, [&](int) { lru->insert(next_key++, 0); }));
+        print("mru_cache::insert evicting", measure(upstream, iterations, [&](int) { mru->insert(next_key++, 0); }));
+        print("adaptive_cache::insert evicting", measure(upstream, adaptive_iterations, [&](int) { cache.insert(next_key++, 0); }));
+    }
+
+    void run_teardown(const bool arena_teardown) {
+        constexpr int capacity = 100'000;
+
+        counting_resource upstream(std::pmr::new_delete_resource());
+        std::pmr::monotonic_buffer_resource arena(&upstream);
+        std::optional<cache_library::lru_cache> cache;
+        cache.emplace(capacity, &arena, arena_teardown);
+        for (int key = 0; key < capacity; ++key) {
+            cache->insert(key, key);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        cache.reset();
+        arena.release();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << "  " << (arena_teardown ? "arena_teardown = true " : "arena_teardown = false")
+            << ": " << std::chrono::duration<double, std::micro>(elapsed).count() << " us for "
+            << capacity << " entries (" << upstream.allocations << " arena chunks)\n";
+    }
+
+} // namespace
+
+void* operator new(const std::size_t size) {
+    heap_calls.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// std::pmr::new_delete_resource виділяє пам'ять через вирівняний operator new
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+    heap_calls.fetch_add(1, std::memory_order_relaxed);
+    const auto align = static_cast<std::size_t>(alignment);
+#ifdef _MSC_VER
+    if (void* p = _aligned_malloc(size == 0 ? 1 : size, align)) {
+#else
+    if (void* p = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+#endif
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+#ifdef _MSC_VER
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void operator delete(void* p, std::size_t, const std::align_val_t alignment) noexcept {
+    operator delete(p, alignment);
+}
+
+int main() {
+    run("Default heap resource:", std::pmr::new_delete_resource(), false);
+    run("Per-instance pool resource:", std::pmr::new_delete_resource(), true);
+
+    std::cout << "lru_cache teardown on a monotonic arena:\n";
+    run_teardown(false);
+    run_teardown(true);
+    return 0;
+}
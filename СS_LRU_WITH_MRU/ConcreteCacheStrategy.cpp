@@ -4,8 +4,10 @@
 
 namespace cache_library {
 
-    concrete_cache_strategy::concrete_cache_strategy(std::shared_ptr<i_cache> lru_cache, std::shared_ptr<i_cache> mru_cache)
-        : lru_cache_(std::move(lru_cache)), mru_cache_(std::move(mru_cache)), dispersionLRU_(0.0), dispersionMRU_(0.0){}
+    concrete_cache_strategy::concrete_cache_strategy(std::shared_ptr<i_cache> lru_cache, std::shared_ptr<i_cache> mru_cache,
+                                                     std::pmr::memory_resource* resource)
+        : lru_cache_(std::move(lru_cache)), mru_cache_(std::move(mru_cache)),
+          accessFrequency_(resource), insertionTime_(resource), dispersionLRU_(0.0), dispersionMRU_(0.0){}
 
     std::shared_ptr<i_cache> concrete_cache_strategy::select_cache(int key) {
         //     
@@ -40,6 +42,12 @@ namespace cache_library {
         calculate_dispersions();
     }
 
+    void concrete_cache_strategy::forget_key(const int key) {
+        //       ,   ' -  
+        accessFrequency_.erase(key);
+        insertionTime_.erase(key);
+    }
+
     void concrete_cache_strategy::calculate_dispersions() {
         double sum_lru = 0.0, sum_mru = 0.0;
         double mean_lru = 0.0, mean_mru = 0.0;
@@ -5,6 +5,7 @@
 #include "ICacheStrategy.hpp"
 #include "ICache.hpp"
 #include <memory>
+#include <memory_resource>
 #include <unordered_map>
 
 namespace cache_library {
@@ -15,10 +16,18 @@ namespace cache_library {
      */
     class concrete_cache_strategy : public i_cache_strategy {
     public:
-        concrete_cache_strategy(std::shared_ptr<i_cache> lru_cache, std::shared_ptr<i_cache> mru_cache);
+        /**
+         * @brief  㳿.
+         * @en Strategy constructor.
+         * @param resource  '     (    ).
+         * @en Memory resource for the access-tracking maps (per-instance pool or arena).
+         */
+        concrete_cache_strategy(std::shared_ptr<i_cache> lru_cache, std::shared_ptr<i_cache> mru_cache,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
         std::shared_ptr<i_cache> select_cache(int key) override;
         void update_strategy(int key) override;
+        void forget_key(int key) override;
 
         //     
         std::shared_ptr<i_cache> lruCache() const override;
@@ -29,8 +38,8 @@ namespace cache_library {
         std::shared_ptr<i_cache> mru_cache_;
 
         // Data structures for tracking access frequencies and times
-        std::unordered_map<int, double> accessFrequency_;
-        std::unordered_map<int, std::chrono::steady_clock::time_point> insertionTime_;
+        std::pmr::unordered_map<int, double> accessFrequency_;
+        std::pmr::unordered_map<int, std::chrono::steady_clock::time_point> insertionTime_;
 
         // Dispersion values
         double dispersionLRU_;
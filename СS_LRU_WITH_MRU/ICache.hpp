@@ -1,6 +1,7 @@
 ﻿#ifndef ICACHE_HPP
 #define ICACHE_HPP
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -67,6 +68,17 @@ namespace cache_library {
          */
         [[nodiscard]] virtual std::vector<int> get_keys() const = 0;
 
+        /**
+         * @brief Встановлює обробник, який викликається для кожного ключа, витісненого через місткість.
+         * @en Set a handler called for every key evicted due to capacity.
+         * @param listener Обробник або порожня функція, щоб вимкнути сповіщення.
+         * @en Handler, or an empty function to disable notifications.
+         *
+         * За замовчуванням нічого не робить: кеші без місткості нічого не витісняють.
+         * @en Does nothing by default: caches without a capacity never evict.
+         */
+        virtual void set_eviction_listener([[maybe_unused]] std::function<void(int)> listener) {}
+
         /**
 		 * @brief Отримання назви стратегії кешування.
 		 * @return Назва стратегії.
@@ -28,6 +28,14 @@ namespace cache_library {
          */
         virtual void update_strategy(int key) = 0;
 
+        /**
+         * @brief Забуває статистику ключа, якого більше немає в жодному кеші.
+         * @en Drop the statistics of a key that is no longer in any cache.
+         * @param key Ключ, який витіснено або видалено.
+         * @en Evicted or removed key.
+         */
+        virtual void forget_key([[maybe_unused]] int key) {}
+
         /**
          * @brief Отримує указівник на LRU кеш.
          * @return Указівник на LRU кеш.
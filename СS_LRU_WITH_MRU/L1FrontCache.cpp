@@ -0,0 +1,203 @@
+#include "L1FrontCache.hpp"
+#include <algorithm>
+#include <bit>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace cache_library {
+
+    namespace {
+
+        std::uint64_t mix(const int key) {
+            // Мультиплікативне хешування (Фібоначчі), бо std::hash<int> є тотожним
+            return static_cast<std::uint64_t>(static_cast<std::uint32_t>(key)) * 0x9E3779B97F4A7C15ull;
+        }
+
+        std::atomic<std::uint64_t> next_instance_id{ 1 };
+
+    } // namespace
+
+    struct l1_front_cache::shared_state {
+        struct alignas(64) padded_version {
+            std::atomic<std::uint64_t> value{ 0 };
+        };
+
+        std::uint64_t id = next_instance_id.fetch_add(1, std::memory_order_relaxed);
+        std::size_t set_mask = 0;
+        std::size_t ways = 1;
+        std::size_t stripe_mask = 0;
+        std::chrono::steady_clock::duration max_staleness{ 0 };
+        std::uint32_t touch_period = 0;
+        std::unique_ptr<padded_version[]> versions;
+        std::atomic<bool> alive{ true }; ///< Скидається деструктором l1_front_cache.
+
+        std::mutex tables_mutex; ///< Захищає реєстр таблиць та лічильники знищених таблиць.
+        std::vector<const thread_table*> tables; ///< Живі таблиці потоків для stats().
+        std::uint64_t retired_hits = 0;
+        std::uint64_t retired_misses = 0;
+
+        [[nodiscard]] std::atomic<std::uint64_t>& stripe(const int key) const {
+            return versions[(mix(key) >> 40) & stripe_mask].value;
+        }
+    };
+
+    struct l1_front_cache::thread_table {
+        struct entry {
+            int key = 0;
+            int value = 0;
+            bool valid = false;
+            std::uint32_t hits = 0; ///< Попадання з моменту заповнення, для вибіркового оновлення давності.
+            std::uint64_t version = 0;
+            std::chrono::steady_clock::time_point filled;
+        };
+
+        explicit thread_table(std::shared_ptr<shared_state> owner)
+            : owner_(std::move(owner)), entries_((owner_->set_mask + 1) * owner_->ways) {
+            std::lock_guard lock(owner_->tables_mutex);
+            owner_->tables.push_back(this);
+        }
+
+        ~thread_table() {
+            // Переносимо лічильники у спільний стан, щоб stats() не втратив їх після знищення таблиці
+            std::lock_guard lock(owner_->tables_mutex);
+            std::erase(owner_->tables, this);
+            owner_->retired_hits += hits_.load(std::memory_order_relaxed);
+            owner_->retired_misses += misses_.load(std::memory_order_relaxed);
+        }
+
+        thread_table(const thread_table&) = delete;
+        thread_table& operator=(const thread_table&) = delete;
+
+        [[nodiscard]] entry* set_of(const int key) {
+            return &entries_[((mix(key) >> 32) & owner_->set_mask) * owner_->ways];
+        }
+
+        void count(const bool hit) {
+            // Лічильник пише лише потік-власник, тому замість атомарного інкременту достатньо load/store
+            std::atomic<std::uint64_t>& counter = hit ? hits_ : misses_;
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        std::shared_ptr<shared_state> owner_;
+        std::vector<entry> entries_;
+        std::atomic<std::uint64_t> hits_{ 0 }; ///< Читаються іншими потоками лише в stats().
+        std::atomic<std::uint64_t> misses_{ 0 };
+    };
+
+    l1_front_cache::l1_front_cache(const l1_cache_options& options)
+        : state_(std::make_shared<shared_state>()) {
+        const std::size_t sets = std::bit_ceil(std::max<std::size_t>(options.sets, 1));
+        const std::size_t stripes = std::bit_ceil(std::max<std::size_t>(options.version_stripes, 1));
+
+        state_->set_mask = sets - 1;
+        state_->ways = std::clamp<std::size_t>(options.ways, 1, 2);
+        state_->stripe_mask = stripes - 1;
+        state_->max_staleness = options.max_staleness;
+        state_->touch_period = options.touch_period;
+        state_->versions = std::make_unique<shared_state::padded_version[]>(stripes);
+    }
+
+    l1_front_cache::~l1_front_cache() {
+        // Таблиці потоків тримають стан через shared_ptr, тому лічильник посилань не показує смерть кешу
+        state_->alive.store(false, std::memory_order_release);
+    }
+
+    l1_front_cache::thread_table& l1_front_cache::local_table() const {
+        struct registry {
+            std::uint64_t last_id = 0;
+            thread_table* last = nullptr;
+            std::unordered_map<std::uint64_t, std::unique_ptr<thread_table>> tables;
+        };
+        thread_local registry local;
+
+        if (local.last_id == state_->id) {
+            return *local.last;
+        }
+
+        auto it = local.tables.find(state_->id);
+        if (it == local.tables.end()) {
+            // Прибираємо таблиці кешів, які вже знищені
+            std::erase_if(local.tables, [](const auto& item) {
+                return !item.second->owner_->alive.load(std::memory_order_acquire);
+            });
+            it = local.tables.emplace(state_->id, std::make_unique<thread_table>(state_)).first;
+        }
+
+        local.last_id = state_->id;
+        local.last = it->second.get();
+        return *local.last;
+    }
+
+    bool l1_front_cache::lookup(const int key, int& value, bool& touch) const {
+        thread_table& table = local_table();
+        thread_table::entry* set = table.set_of(key);
+        const std::uint64_t current = state_->stripe(key).load(std::memory_order_acquire);
+
+        for (std::size_t way = 0; way < state_->ways; ++way) {
+            thread_table::entry& item = set[way];
+            if (!item.valid || item.key != key) {
+                continue;
+            }
+            if (item.version != current ||
+                (state_->max_staleness.count() > 0 &&
+                    std::chrono::steady_clock::now() - item.filled > state_->max_staleness)) {
+                item.valid = false;
+                break;
+            }
+
+            value = item.value;
+            touch = state_->touch_period != 0 && ++item.hits % state_->touch_period == 0;
+            if (way != 0) {
+                std::swap(set[0], item); // Гарячий запис тримаємо в першому слоті набору
+            }
+            table.count(true);
+            return true;
+        }
+
+        table.count(false);
+        return false;
+    }
+
+    std::uint64_t l1_front_cache::version(const int key) const {
+        return state_->stripe(key).load(std::memory_order_acquire);
+    }
+
+    void l1_front_cache::fill(const int key, const int value, const std::uint64_t version) const {
+        thread_table::entry* set = local_table().set_of(key);
+
+        std::size_t way = 0;
+        while (way < state_->ways && !(set[way].valid && set[way].key == key)) {
+            ++way;
+        }
+        if (way == state_->ways) {
+            // Нового ключа немає в наборі: витісняємо останній слот
+            way = state_->ways - 1;
+        }
+        std::rotate(set, set + way, set + way + 1);
+
+        set[0].key = key;
+        set[0].value = value;
+        set[0].valid = true;
+        set[0].hits = 0;
+        set[0].version = version;
+        if (state_->max_staleness.count() > 0) {
+            set[0].filled = std::chrono::steady_clock::now();
+        }
+    }
+
+    void l1_front_cache::invalidate(const int key) const {
+        state_->stripe(key).fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    l1_cache_stats l1_front_cache::stats() const {
+        std::lock_guard lock(state_->tables_mutex);
+        l1_cache_stats result{ state_->retired_hits, state_->retired_misses };
+        for (const thread_table* table : state_->tables) {
+            result.hits += table->hits_.load(std::memory_order_relaxed);
+            result.misses += table->misses_.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+} // namespace cache_library
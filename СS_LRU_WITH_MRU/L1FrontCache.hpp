@@ -0,0 +1,107 @@
+#ifndef L1_FRONT_CACHE_HPP
+#define L1_FRONT_CACHE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cache_library {
+
+    /**
+     * @struct l1_cache_options
+     * @brief Налаштування потокового L1 кешу перед adaptive_cache.
+     * @en Settings of the per-thread L1 cache in front of adaptive_cache.
+     */
+    struct l1_cache_options {
+        std::size_t sets = 256; ///< Кількість наборів (округлюється до степеня двійки). / @en Number of sets (rounded up to a power of two).
+        std::size_t ways = 2; ///< Асоціативність: 1 (direct-mapped) або 2. / @en Associativity: 1 (direct-mapped) or 2.
+        std::size_t version_stripes = 64; ///< Кількість лічильників версій. / @en Number of version counters.
+        std::chrono::milliseconds max_staleness{ 0 }; ///< Максимальний вік запису, 0 - без обмеження. / @en Maximum entry age, 0 means unbounded.
+        std::uint32_t touch_period = 16; ///< Кожне N-те попадання ключа оновлює його давність у спільному кеші, 0 - ніколи. / @en Every Nth hit of a key refreshes its recency in the shared cache, 0 means never.
+    };
+
+    /**
+     * @struct l1_cache_stats
+     * @brief Лічильники попадань та промахів L1 кешу.
+     * @en Hit and miss counters of the L1 cache.
+     */
+    struct l1_cache_stats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+
+        [[nodiscard]] double hit_ratio() const {
+            const std::uint64_t total = hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+        }
+    };
+
+    /**
+     * @class l1_front_cache
+     * @brief Невеликий потоковий (thread_local) кеш для гарячих ключів.
+     * @en Small thread-local cache for hot keys.
+     *
+     * Кожен потік має власну таблицю, тому попадання не беруть блокувань і не пишуть у спільну пам'ять.
+     * Записи перевіряються лічильником версії смуги ключа, який збільшується при insert/remove та витісненні.
+     * @en Every thread owns its table, so hits take no locks and write no shared memory.
+     * Entries are validated against the version counter of the key's stripe, bumped on insert/remove and eviction.
+     */
+    class l1_front_cache {
+    public:
+        explicit l1_front_cache(const l1_cache_options& options = {});
+        ~l1_front_cache();
+
+        l1_front_cache(const l1_front_cache&) = delete;
+        l1_front_cache& operator=(const l1_front_cache&) = delete;
+
+        /**
+         * @brief Пошук ключа в таблиці поточного потоку.
+         * @en Look up a key in the calling thread's table.
+         * @param key Ключ для пошуку.
+         * @en Key to look up.
+         * @param value Знайдене значення.
+         * @en Found value.
+         * @param touch true, якщо це touch_period-те попадання і давність ключа слід оновити у спільному кеші.
+         * @en true when this is the touch_period-th hit and the key's recency should be refreshed in the shared cache.
+         * @return true, якщо запис актуальний.
+         * @en true if the entry is still valid.
+         */
+        bool lookup(int key, int& value, bool& touch) const;
+
+        /**
+         * @brief Поточна версія смуги ключа; читається до звернення до спільного кешу.
+         * @en Current version of the key's stripe; read before consulting the shared cache.
+         */
+        [[nodiscard]] std::uint64_t version(int key) const;
+
+        /**
+         * @brief Зберігає значення в таблиці поточного потоку з версією, прочитаною до звернення.
+         * @en Store a value in the calling thread's table with the version read beforehand.
+         */
+        void fill(int key, int value, std::uint64_t version) const;
+
+        /**
+         * @brief Робить недійсними записи ключа в усіх потоках.
+         * @en Invalidate the key's entries in every thread.
+         */
+        void invalidate(int key) const;
+
+        /**
+         * @brief Сумарна статистика всіх потоків: живих таблиць та вже знищених.
+         * @en Statistics summed over all threads: live tables and already destroyed ones.
+         */
+        [[nodiscard]] l1_cache_stats stats() const;
+
+    private:
+        struct shared_state;
+        struct thread_table;
+
+        thread_table& local_table() const;
+
+        std::shared_ptr<shared_state> state_; ///< Версії та лічильники, спільні для всіх потоків.
+    };
+
+} // namespace cache_library
+
+#endif // L1_FRONT_CACHE_HPP
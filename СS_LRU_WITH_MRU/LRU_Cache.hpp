@@ -5,6 +5,7 @@
 #include <list>
 #include <unordered_map>
 #include <iostream>
+#include <memory_resource>
 #include <vector>
 
 namespace cache_library {
@@ -21,8 +22,19 @@ namespace cache_library {
          * @en Constructor to initialize the cache with a given capacity.
          * @param capacity Місткість кешу.
          * @en Cache capacity.
+         * @param resource Джерело пам'яті для вузлів кешу (пул або арена на екземпляр).
+         * @en Memory resource for cache nodes (per-instance pool or arena).
+         * @param arena_teardown true - деструктор не звільняє вузли по одному; пам'ять повертається
+         * разом з ареною (наприклад, std::pmr::monotonic_buffer_resource::release()).
+         * @en true - the destructor does not free nodes one by one; memory is returned together with the
+         * arena (e.g. std::pmr::monotonic_buffer_resource::release()). Only for an arena that outlives the cache.
          */
-        explicit lru_cache(int capacity = 10);
+        explicit lru_cache(int capacity = 10, std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+                           bool arena_teardown = false);
+        ~lru_cache() override;
+
+        lru_cache(const lru_cache&) = delete;
+        lru_cache& operator=(const lru_cache&) = delete;
 
         void insert(int key, int value) override;
         int get(int key) override;
@@ -30,12 +42,16 @@ namespace cache_library {
         void remove(int key) override;
         void display_status() const override;
         [[nodiscard]] std::vector<int> get_keys() const override;
+        void set_eviction_listener(std::function<void(int)> listener) override;
         [[nodiscard]] std::string get_strategy_name() const override;
     private:
-        std::list<int> cache_keys_;
-        std::unordered_map<int, std::list<int>::iterator> key_map_;
-        std::unordered_map<int, int> value_map_; ///< Відображення ключів на значення.
+        // Контейнери в анонімних об'єднаннях, щоб деструктор міг не викликати їхні деструктори в режимі арени
+        union { std::pmr::list<int> cache_keys_; };
+        union { std::pmr::unordered_map<int, std::pmr::list<int>::iterator> key_map_; };
+        union { std::pmr::unordered_map<int, int> value_map_; }; ///< Відображення ключів на значення.
         int capacity_;
+        bool arena_teardown_; ///< Пропустити звільнення вузлів у деструкторі.
+        std::function<void(int)> eviction_listener_; ///< Обробник витіснених ключів.
     };
 
 } // namespace CacheLibrary
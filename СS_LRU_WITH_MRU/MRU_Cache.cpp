@@ -1,10 +1,26 @@
 ﻿#include "MRU_Cache.hpp"
+#include <memory>
 
 #include "AdaptiveCache.hpp"
 
 namespace cache_library {
 
-    mru_cache::mru_cache(const int capacity) : capacity_(capacity) {}
+    mru_cache::mru_cache(const int capacity, std::pmr::memory_resource* resource, const bool arena_teardown)
+        : cache_keys_(resource), key_map_(resource), value_map_(resource), capacity_(capacity),
+          arena_teardown_(arena_teardown) {
+        // Резервуємо кошики заздалегідь, щоб у сталому режимі не було перехешування
+        key_map_.reserve(capacity_);
+        value_map_.reserve(capacity_);
+    }
+
+    mru_cache::~mru_cache() {
+        // Вузли містять лише int, тож у режимі арени достатньо не звільняти їх: пам'ять забере арена за O(1)
+        if (!arena_teardown_) {
+            std::destroy_at(&value_map_);
+            std::destroy_at(&key_map_);
+            std::destroy_at(&cache_keys_);
+        }
+    }
 
     void mru_cache::insert(const int key, const int value) {
         if (!key_map_.contains(key)) {
@@ -12,10 +28,17 @@ namespace cache_library {
 	            const int first_key = cache_keys_.front();
                 cache_keys_.pop_front();
                 key_map_.erase(first_key);
+                value_map_.erase(first_key); // Видаляємо значення
+                if (eviction_listener_) {
+                    eviction_listener_(first_key);
+                }
             }
         }
         else {
-            cache_keys_.erase(key_map_[key]);
+            // Переносимо наявний вузол у кінець без перевиділення
+            cache_keys_.splice(cache_keys_.end(), cache_keys_, key_map_[key]);
+            value_map_[key] = value;
+            return;
         }
         cache_keys_.push_back(key);
         key_map_[key] = --cache_keys_.end();
@@ -23,10 +46,9 @@ namespace cache_library {
     }
 
     int mru_cache::get(const int key) {
-        if (key_map_.contains(key)) {
-            cache_keys_.erase(key_map_[key]);
-            cache_keys_.push_back(key);
-            key_map_[key] = --cache_keys_.end();
+        if (const auto it = key_map_.find(key); it != key_map_.end()) {
+            // splice зберігає ітератор вузла, тому попадання не виділяє пам'ять
+            cache_keys_.splice(cache_keys_.end(), cache_keys_, it->second);
             return value_map_[key]; // Повертаємо значення
         }
         return -1; // Або використовуйте інший спосіб обробки відсутнього ключа
@@ -56,6 +78,10 @@ namespace cache_library {
         return { cache_keys_.begin(), cache_keys_.end() };
     }
 
+    void mru_cache::set_eviction_listener(std::function<void(int)> listener) {
+        eviction_listener_ = std::move(listener);
+    }
+
     std::string mru_cache::get_strategy_name() const {
         return "MRU";
     }
@@ -0,0 +1,309 @@
+#include "SnapshotCache.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace cache_library {
+
+    namespace {
+
+        /**
+         * @brief Слот читача: епоха, в якій потік увійшов у читання, або 0 поза читанням.
+         * @en Reader slot: the epoch the thread entered a read in, or 0 outside of reads.
+         */
+        struct alignas(64) reader_slot {
+            std::atomic<std::uint64_t> epoch{ 0 };
+            std::atomic<bool> in_use{ true };
+            reader_slot* next = nullptr;
+        };
+
+        std::atomic<std::uint64_t> global_epoch{ 1 };
+        std::atomic<reader_slot*> slots_head{ nullptr }; ///< Слоти ніколи не звільняються, лише перевикористовуються.
+
+        reader_slot* acquire_slot() {
+            for (reader_slot* slot = slots_head.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+                bool expected = false;
+                if (slot->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                    return slot;
+                }
+            }
+
+            auto* slot = new reader_slot();
+            slot->next = slots_head.load(std::memory_order_relaxed);
+            while (!slots_head.compare_exchange_weak(slot->next, slot, std::memory_order_acq_rel)) {}
+            return slot;
+        }
+
+        std::atomic<std::uint64_t> next_instance_id{ 1 };
+
+        struct thread_reader {
+            reader_slot* slot = acquire_slot();
+
+            ~thread_reader() {
+                slot->epoch.store(0, std::memory_order_release);
+                slot->in_use.store(false, std::memory_order_release);
+            }
+        };
+
+        thread_reader& local_reader() {
+            thread_local thread_reader reader;
+            return reader;
+        }
+
+        /**
+         * @class read_guard
+         * @brief Оголошує епоху читача на час доступу до знімка.
+         * @en Announces the reader's epoch while a snapshot is accessed.
+         *
+         * Пише лише у власний слот потоку, тому читачі не змагаються за спільні лінії кешу.
+         * @en Writes only the thread's own slot, so readers never contend on shared cache lines.
+         */
+        class read_guard {
+        public:
+            read_guard() : slot_(local_reader().slot) {
+                // seq_cst: оголошення має бути видно записувачу до читання вказівника на знімок
+                slot_->epoch.store(global_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            }
+
+            ~read_guard() { slot_->epoch.store(0, std::memory_order_release); }
+
+            read_guard(const read_guard&) = delete;
+            read_guard& operator=(const read_guard&) = delete;
+
+        private:
+            reader_slot* slot_;
+        };
+
+        /**
+         * @brief Лічильник читань потоку для вибірки статистики окремого snapshot_cache.
+         * @en Per-thread read counter used to sample the statistics of one snapshot_cache.
+         */
+        struct sample_counter {
+            std::shared_ptr<const std::atomic<bool>> alive; ///< Прапорець життя кешу-власника.
+            std::uint32_t reads = 0;
+        };
+
+        std::uint32_t& local_reads(const std::uint64_t id, const std::shared_ptr<const std::atomic<bool>>& alive) {
+            struct registry {
+                std::uint64_t last_id = 0;
+                std::uint32_t* last = nullptr;
+                std::unordered_map<std::uint64_t, sample_counter> counters;
+            };
+            thread_local registry local;
+
+            if (local.last_id == id) {
+                return *local.last;
+            }
+
+            auto it = local.counters.find(id);
+            if (it == local.counters.end()) {
+                // Прибираємо лічильники кешів, які вже знищені
+                std::erase_if(local.counters, [](const auto& item) {
+                    return !item.second.alive->load(std::memory_order_acquire);
+                });
+                it = local.counters.emplace(id, sample_counter{ alive }).first;
+            }
+
+            local.last_id = id;
+            local.last = &it->second.reads;
+            return *local.last;
+        }
+
+        std::uint64_t oldest_active_epoch() {
+            std::uint64_t oldest = UINT64_MAX;
+            for (reader_slot* slot = slots_head.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+                const std::uint64_t epoch = slot->epoch.load(std::memory_order_seq_cst);
+                if (epoch != 0) {
+                    oldest = std::min(oldest, epoch);
+                }
+            }
+            return oldest;
+        }
+
+    } // namespace
+
+    snapshot_cache::snapshot_cache(const snapshot_options& options)
+        : options_(options), id_(next_instance_id.fetch_add(1, std::memory_order_relaxed)),
+          alive_(std::make_shared<std::atomic<bool>>(true)), current_(new snapshot()) {}
+
+    snapshot_cache::~snapshot_cache() {
+        alive_->store(false, std::memory_order_release);
+
+        // Під час знищення читачів уже не може бути
+        for (const retired_snapshot& item : retired_) {
+            delete item.data;
+        }
+        delete current_.load(std::memory_order_relaxed);
+    }
+
+    const int* snapshot_cache::find(const snapshot& data, const int key) {
+        const auto it = std::ranges::lower_bound(data.keys, key);
+        if (it == data.keys.end() || *it != key) {
+            return nullptr;
+        }
+        return &data.values[static_cast<std::size_t>(it - data.keys.begin())];
+    }
+
+    void snapshot_cache::insert(const int key, const int value) {
+        std::lock_guard lock(writer_mutex_);
+        pending_[key] = value;
+        if (options_.batch_size != 0 && pending_.size() >= options_.batch_size) {
+            publish_locked(nullptr);
+        }
+    }
+
+    void snapshot_cache::remove(const int key) {
+        std::lock_guard lock(writer_mutex_);
+        pending_[key] = std::nullopt;
+        if (options_.batch_size != 0 && pending_.size() >= options_.batch_size) {
+            publish_locked(nullptr);
+        }
+    }
+
+    int snapshot_cache::get(const int key) {
+        int value = -1;
+        {
+            read_guard guard;
+            if (const int* found = find(*current_.load(std::memory_order_seq_cst), key)) {
+                value = *found;
+            }
+        }
+
+        if (value != -1 && options_.sample_period != 0) {
+            std::uint32_t& reads = local_reads(id_, alive_);
+            if (++reads >= options_.sample_period) {
+                reads = 0;
+                record_sample(key);
+            }
+        }
+        return value; // -1, якщо ключа немає в опублікованому знімку
+    }
+
+    bool snapshot_cache::contains(const int key) const {
+        read_guard guard;
+        return find(*current_.load(std::memory_order_seq_cst), key) != nullptr;
+    }
+
+    void snapshot_cache::publish() {
+        std::lock_guard lock(writer_mutex_);
+        publish_locked(nullptr);
+    }
+
+    void snapshot_cache::rebuild(std::vector<std::pair<int, int>> entries) {
+        std::ranges::stable_sort(entries, {}, &std::pair<int, int>::first);
+
+        auto* next = new snapshot();
+        next->keys.reserve(entries.size());
+        next->values.reserve(entries.size());
+        for (const auto& [key, value] : entries) {
+            // Для повторюваних ключів залишаємо останнє значення
+            if (!next->keys.empty() && next->keys.back() == key) {
+                next->values.back() = value;
+                continue;
+            }
+            next->keys.push_back(key);
+            next->values.push_back(value);
+        }
+
+        std::lock_guard lock(writer_mutex_);
+        pending_.clear();
+        publish_locked(next);
+    }
+
+    void snapshot_cache::publish_locked(const snapshot* next) {
+        if (next == nullptr) {
+            if (pending_.empty()) {
+                return;
+            }
+
+            // Зливаємо поточний знімок з відсортованим пакетом змін
+            const snapshot& base = *current_.load(std::memory_order_relaxed);
+            auto* merged = new snapshot();
+            merged->keys.reserve(base.keys.size() + pending_.size());
+            merged->values.reserve(base.keys.size() + pending_.size());
+
+            std::size_t i = 0;
+            auto change = pending_.begin();
+            while (i < base.keys.size() || change != pending_.end()) {
+                if (change == pending_.end() || (i < base.keys.size() && base.keys[i] < change->first)) {
+                    merged->keys.push_back(base.keys[i]);
+                    merged->values.push_back(base.values[i]);
+                    ++i;
+                    continue;
+                }
+                if (i < base.keys.size() && base.keys[i] == change->first) {
+                    ++i;
+                }
+                if (change->second) {
+                    merged->keys.push_back(change->first);
+                    merged->values.push_back(*change->second);
+                }
+                ++change;
+            }
+
+            merged->keys.shrink_to_fit();
+            merged->values.shrink_to_fit();
+            pending_.clear();
+            next = merged;
+        }
+
+        const snapshot* previous = current_.exchange(next, std::memory_order_seq_cst);
+        retired_.push_back({ previous, global_epoch.fetch_add(1, std::memory_order_seq_cst) });
+        reclaim_locked();
+
+        // Статистика потрібна лише для ключів, які є в новому знімку
+        std::lock_guard lock(stats_mutex_);
+        std::erase_if(samples_, [next](const auto& item) { return find(*next, item.first) == nullptr; });
+    }
+
+    void snapshot_cache::reclaim_locked() {
+        // Знімок можна видалити, коли всі активні читачі увійшли після його заміни
+        const std::uint64_t oldest = oldest_active_epoch();
+        std::erase_if(retired_, [oldest](const retired_snapshot& item) {
+            if (item.epoch < oldest) {
+                delete item.data;
+                return true;
+            }
+            return false;
+        });
+    }
+
+    void snapshot_cache::record_sample(const int key) {
+        read_guard guard;
+        std::lock_guard lock(stats_mutex_);
+        // Ключ міг зникнути після читання; не повертаємо його у вже очищену статистику
+        if (find(*current_.load(std::memory_order_seq_cst), key) == nullptr) {
+            return;
+        }
+        snapshot_sample& sample = samples_[key];
+        ++sample.hits;
+        sample.last_access = std::chrono::steady_clock::now();
+    }
+
+    std::unordered_map<int, snapshot_sample> snapshot_cache::sampled_stats() const {
+        std::lock_guard lock(stats_mutex_);
+        return samples_;
+    }
+
+    void snapshot_cache::display_status() const {
+        std::cout << "Snapshot Cache Status:\n";
+        {
+            read_guard guard;
+            const snapshot& data = *current_.load(std::memory_order_seq_cst);
+            for (std::size_t i = 0; i < data.keys.size(); ++i) {
+                std::cout << "Key: " << data.keys[i] << ", Value: " << data.values[i] << " ";
+            }
+        }
+        std::lock_guard lock(writer_mutex_);
+        std::cout << "\nPending updates: " << pending_.size() << '\n';
+    }
+
+    std::vector<int> snapshot_cache::get_keys() const {
+        read_guard guard;
+        return current_.load(std::memory_order_seq_cst)->keys;
+    }
+
+    std::string snapshot_cache::get_strategy_name() const {
+        return "Snapshot";
+    }
+
+} // namespace cache_library
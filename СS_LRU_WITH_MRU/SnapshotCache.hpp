@@ -0,0 +1,147 @@
+#ifndef SNAPSHOT_CACHE_HPP
+#define SNAPSHOT_CACHE_HPP
+
+#include "ICache.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cache_library {
+
+    /**
+     * @struct snapshot_options
+     * @brief Налаштування кешу зі знімками для режиму "переважно читання".
+     * @en Settings of the read-mostly snapshot cache.
+     */
+    struct snapshot_options {
+        std::size_t batch_size = 1; ///< Кількість змін до автоматичної публікації (1 - кожна зміна), 0 - лише publish(). / @en Pending updates before an automatic publish (1 publishes every write), 0 means publish() only.
+        std::uint32_t sample_period = 1024; ///< Статистика записується для одного з N читань, 0 - вимкнено. / @en Statistics are recorded for one read in N, 0 disables them.
+    };
+
+    /**
+     * @struct snapshot_sample
+     * @brief Вибіркова статистика доступу до ключа.
+     * @en Sampled access statistics of a key.
+     */
+    struct snapshot_sample {
+        std::uint64_t hits = 0; ///< Кількість вибраних читань. / @en Number of sampled reads.
+        std::chrono::steady_clock::time_point last_access; ///< Час останнього вибраного читання. / @en Time of the last sampled read.
+    };
+
+    /**
+     * @class snapshot_cache
+     * @brief Кеш для даних, що рідко змінюються: читання йдуть по незмінному знімку без блокувань.
+     * @en Cache for rarely changing data: reads go to an immutable snapshot without locks.
+     *
+     * Знімок - відсортовані масиви ключів та значень, доступні через вказівник під захистом епох.
+     * За замовчуванням кожна зміна публікується одразу; для режиму "переважно читання" збільште batch_size.
+     * @en The snapshot is a pair of sorted key and value arrays behind an epoch-protected pointer.
+     * By default every write is published at once; raise batch_size for read-mostly use.
+     */
+    class snapshot_cache final : public i_cache {
+    public:
+        explicit snapshot_cache(const snapshot_options& options = {});
+        ~snapshot_cache() override;
+
+        snapshot_cache(const snapshot_cache&) = delete;
+        snapshot_cache& operator=(const snapshot_cache&) = delete;
+
+        /**
+         * @brief Вставка ключа у пакет змін.
+         * @en Insert a key into the pending batch.
+         * @param key Ключ для збереження в кеші.
+         * @en Key to store in the cache.
+         * @param value Значення, яке буде прив'язано до ключа.
+         * @en Value to associate with the key.
+         *
+         * Зміна стає видимою для get/contains лише після публікації: одразу при batch_size = 1,
+         * після batch_size змін або після publish().
+         * @en The change becomes visible to get/contains only once published: immediately with
+         * batch_size = 1, after batch_size pending changes, or after publish().
+         */
+        void insert(int key, int value) override;
+
+        /**
+         * @brief Отримання значення з опублікованого знімка без блокувань.
+         * @en Retrieve a value from the published snapshot without locks.
+         * @param key Ключ, який потрібно отримати.
+         * @en Key to retrieve.
+         * @return Значення ключа або -1, якщо ключа немає в опублікованому знімку.
+         * @en Value of the key or -1 if the key is not in the published snapshot.
+         */
+        int get(int key) override;
+        [[nodiscard]] bool contains(int key) const override;
+
+        /**
+         * @brief Видалення ключа через пакет змін.
+         * @en Remove a key through the pending batch.
+         * @param key Ключ для видалення.
+         * @en Key to remove.
+         *
+         * Як і insert, видалення стає видимим лише після публікації.
+         * @en Like insert, the removal becomes visible only once published.
+         */
+        void remove(int key) override;
+        void display_status() const override;
+        [[nodiscard]] std::vector<int> get_keys() const override;
+        [[nodiscard]] std::string get_strategy_name() const override;
+
+        /**
+         * @brief Публікує новий знімок з усіма накопиченими змінами.
+         * @en Publish a new snapshot with all pending updates.
+         */
+        void publish();
+
+        /**
+         * @brief Повністю замінює вміст кешу та одразу публікує знімок.
+         * @en Replace the whole cache content and publish it immediately.
+         * @param entries Пари ключ-значення.
+         * @en Key-value pairs.
+         */
+        void rebuild(std::vector<std::pair<int, int>> entries);
+
+        /**
+         * @brief Повертає вибіркову статистику доступу для ключів поточного знімка.
+         * @en Retrieve the sampled access statistics of keys in the current snapshot.
+         */
+        [[nodiscard]] std::unordered_map<int, snapshot_sample> sampled_stats() const;
+
+    private:
+        struct snapshot {
+            std::vector<int> keys; ///< Відсортовані ключі.
+            std::vector<int> values; ///< Значення у тому ж порядку.
+        };
+
+        struct retired_snapshot {
+            const snapshot* data;
+            std::uint64_t epoch;
+        };
+
+        [[nodiscard]] static const int* find(const snapshot& data, int key);
+        void publish_locked(const snapshot* next);
+        void reclaim_locked();
+        void record_sample(int key);
+
+        snapshot_options options_;
+        const std::uint64_t id_; ///< Ідентифікатор для потокових лічильників вибірки.
+        std::shared_ptr<std::atomic<bool>> alive_; ///< Скидається деструктором, щоб потоки прибрали свої лічильники.
+        std::atomic<const snapshot*> current_; ///< Опублікований знімок.
+
+        mutable std::mutex writer_mutex_; ///< Захищає пакет змін та список знімків на видалення.
+        std::map<int, std::optional<int>> pending_; ///< Накопичені зміни (nullopt - видалення).
+        std::vector<retired_snapshot> retired_;
+
+        mutable std::mutex stats_mutex_;
+        std::unordered_map<int, snapshot_sample> samples_;
+    };
+
+} // namespace cache_library
+
+#endif // SNAPSHOT_CACHE_HPP